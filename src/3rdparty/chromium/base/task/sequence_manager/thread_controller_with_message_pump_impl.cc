@@ -14,6 +14,7 @@
 #include "base/memory/ptr_util.h"
 #include "base/memory/raw_ref.h"
 #include "base/message_loop/message_pump.h"
+#include "base/metrics/field_trial_params.h"
 #include "base/metrics/histogram.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/task/common/task_annotator.h"
@@ -53,6 +54,15 @@ BASE_FEATURE(kRunTasksByBatches,
              "RunTasksByBatches",
              base::FEATURE_DISABLED_BY_DEFAULT);
 
+// How long a batch may keep running tasks before yielding to the native
+// message loop. Embedders whose native loop has its own per-iteration cost
+// (e.g. an event dispatch per wake-up) can raise this to drain more work per
+// wake-up.
+constexpr base::TimeDelta kDefaultRunTasksByBatchesDuration =
+    base::Milliseconds(8);
+const base::FeatureParam<base::TimeDelta> kRunTasksByBatchesDuration{
+    &kRunTasksByBatches, "batch_duration", kDefaultRunTasksByBatchesDuration};
+
 #if BUILDFLAG(IS_WIN)
 // If enabled, deactivate the high resolution timer immediately in DoWork(),
 // instead of waiting for next DoIdleWork.
@@ -64,6 +74,8 @@ std::atomic_bool g_use_less_high_res_timers = false;
 
 std::atomic_bool g_align_wake_ups = false;
 std::atomic_bool g_run_tasks_by_batches = false;
+std::atomic<int64_t> g_run_tasks_by_batches_duration_us =
+    kDefaultRunTasksByBatchesDuration.InMicroseconds();
 #if BUILDFLAG(IS_WIN)
 bool g_explicit_high_resolution_timer_win = false;
 #endif  // BUILDFLAG(IS_WIN)
@@ -91,6 +103,10 @@ void ThreadControllerWithMessagePumpImpl::InitializeFeatures() {
   g_align_wake_ups = FeatureList::IsEnabled(kAlignWakeUps);
   g_run_tasks_by_batches.store(FeatureList::IsEnabled(kRunTasksByBatches),
                                std::memory_order_relaxed);
+  g_run_tasks_by_batches_duration_us.store(
+      std::max(kRunTasksByBatchesDuration.Get(), base::Milliseconds(1))
+          .InMicroseconds(),
+      std::memory_order_relaxed);
 #if BUILDFLAG(IS_WIN)
   g_explicit_high_resolution_timer_win =
       FeatureList::IsEnabled(kExplicitHighResolutionTimerWin);
@@ -107,6 +123,9 @@ void ThreadControllerWithMessagePumpImpl::ResetFeatures() {
   g_run_tasks_by_batches.store(
       kRunTasksByBatches.default_state == FEATURE_ENABLED_BY_DEFAULT,
       std::memory_order_relaxed);
+  g_run_tasks_by_batches_duration_us.store(
+      kDefaultRunTasksByBatchesDuration.InMicroseconds(),
+      std::memory_order_relaxed);
 }
 
 ThreadControllerWithMessagePumpImpl::ThreadControllerWithMessagePumpImpl(
@@ -427,8 +446,8 @@ WorkDetails ThreadControllerWithMessagePumpImpl::DoWorkImpl(
 
   DCHECK(main_thread_only().task_source);
 
-  // Keep running tasks for up to 8ms before yielding to the pump when
-  // |g_run_tasks_by_batches| is true.
+  // Keep running tasks for up to |kRunTasksByBatchesDuration| (8ms by default)
+  // before yielding to the pump when |g_run_tasks_by_batches| is true.
   const base::TimeDelta batch_duration = GetAlternationInterval();
 
   const absl::optional<base::TimeTicks> start_time =
@@ -439,10 +458,10 @@ WorkDetails ThreadControllerWithMessagePumpImpl::DoWorkImpl(
   base::TimeDelta work_executed = base::Milliseconds(0);
   // Loops for |batch_duration|, or |work_batch_size| times if |batch_duration|
   // is zero.
-  for (int num_tasks_executed = 0;
-       (!batch_duration.is_zero() && work_executed < batch_duration) ||
-       (batch_duration.is_zero() &&
-        num_tasks_executed < main_thread_only().work_batch_size);
+  int num_tasks_executed = 0;
+  for (; (!batch_duration.is_zero() && work_executed < batch_duration) ||
+         (batch_duration.is_zero() &&
+          num_tasks_executed < main_thread_only().work_batch_size);
        ++num_tasks_executed) {
     LazyNow lazy_now_select_task(recent_time, time_source_);
     // Include SelectNextTask() in the scope of the work item. This ensures
@@ -523,6 +542,11 @@ WorkDetails ThreadControllerWithMessagePumpImpl::DoWorkImpl(
   if (main_thread_only().quit_pending)
     return {absl::nullopt, Nanoseconds(0)};
 
+  // Lets the batch budget be tuned from traces: a batch that routinely runs
+  // a single task means the pump wakes up once per task.
+  TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("sequence_manager"),
+                 "ThreadControllerImpl::TasksPerBatch", num_tasks_executed);
+
   work_deduplicator_.WillCheckForMoreWork();
 
   // Re-check the state of the power after running tasks. An executed task may
@@ -750,7 +774,8 @@ base::TimeDelta ThreadControllerWithMessagePumpImpl::GetAlternationInterval() {
              : periodic_yielding_to_native_interval_;
 #else
   return g_run_tasks_by_batches.load(std::memory_order_relaxed)
-             ? base::Milliseconds(8)
+             ? base::Microseconds(g_run_tasks_by_batches_duration_us.load(
+                   std::memory_order_relaxed))
              : base::Milliseconds(0);
 #endif
 }
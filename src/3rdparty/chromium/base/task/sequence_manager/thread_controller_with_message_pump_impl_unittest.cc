@@ -1116,6 +1116,27 @@ TEST_F(ThreadControllerWithMessagePumpTest, DoWorkBatchesForSetTime) {
   EXPECT_EQ(task_counter, 2);
   ThreadControllerWithMessagePumpImpl::ResetFeatures();
 }
+
+TEST_F(ThreadControllerWithMessagePumpTest, DoWorkBatchesForConfiguredTime) {
+  base::test::ScopedFeatureList scoped_feature_list_;
+
+  scoped_feature_list_.InitAndEnableFeatureWithParameters(
+      kRunTasksByBatches, {{"batch_duration", "12ms"}});
+  ThreadControllerWithMessagePumpImpl::InitializeFeatures();
+
+  int task_counter = 0;
+
+  for (int i = 0; i < 4; i++) {
+    task_source_.AddTask(FROM_HERE, BindLambdaForTesting([&] {
+                           clock_.Advance(Milliseconds(4));
+                           task_counter++;
+                         }));
+  }
+  thread_controller_.DoWork();
+
+  EXPECT_EQ(task_counter, 3);
+  ThreadControllerWithMessagePumpImpl::ResetFeatures();
+}
 #endif  // BUILDFLAG(IS_ANDROID)
 TEST_F(ThreadControllerWithMessagePumpTest,
        ThreadControllerActiveAdvancedNesting) {
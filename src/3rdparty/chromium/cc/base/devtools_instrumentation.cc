@@ -56,6 +56,17 @@ const char kCommit[] = "Commit";
 const char kPaintSetup[] = "PaintSetup";
 const char kUpdateLayer[] = "UpdateLayer";
 
+const char* ImageDecodeSizeSuffix(uint64_t area) {
+  constexpr uint64_t kMegapixel = 1000 * 1000;
+  if (area < kMegapixel)
+    return "Small";
+  if (area < 4 * kMegapixel)
+    return "Medium";
+  if (area < 16 * kMegapixel)
+    return "Large";
+  return "Huge";
+}
+
 ScopedImageUploadTask::ScopedImageUploadTask(const void* image_ptr,
                                              ImageType image_type)
     : ScopedImageTask(image_type) {
@@ -162,6 +173,22 @@ ScopedImageDecodeTask::~ScopedImageDecodeTask() {
           hist_min_, hist_max_, bucket_count_, decode_type_);
       break;
   }
+
+  if (!decoded_area_)
+    return;
+  const std::string size_suffix = ImageDecodeSizeSuffix(decoded_area_);
+  switch (task_type_) {
+    case kInRaster:
+      RecordMicrosecondTimesUmaByDecodeType(
+          "Renderer4.ImageDecodeTaskDurationUs." + size_suffix, duration,
+          hist_min_, hist_max_, bucket_count_, decode_type_);
+      break;
+    case kOutOfRaster:
+      RecordMicrosecondTimesUmaByDecodeType(
+          "Renderer4.ImageDecodeTaskDurationUs.OutOfRaster." + size_suffix,
+          duration, hist_min_, hist_max_, bucket_count_, decode_type_);
+      break;
+  }
 }
 
 }  // namespace devtools_instrumentation
@@ -52,6 +52,11 @@ CC_BASE_EXPORT extern const char kCommit[];
 extern const char kPaintSetup[];
 CC_BASE_EXPORT extern const char kUpdateLayer[];
 
+// Returns the histogram suffix ("Small", "Medium", "Large" or "Huge") for an
+// image decoded to |area| pixels, split at 1, 4 and 16 megapixels. Shared with
+// Blink's decoder histograms so that the two families can be compared.
+CC_BASE_EXPORT const char* ImageDecodeSizeSuffix(uint64_t area);
+
 class CC_BASE_EXPORT ScopedLayerTask {
  public:
   ScopedLayerTask(const char* event_name, int layer_id)
@@ -118,9 +123,14 @@ class CC_BASE_EXPORT ScopedImageDecodeTask : public ScopedImageTask {
 
   ScopedImageDecodeTask& operator=(const ScopedImageDecodeTask&) = delete;
 
+  // Additionally records the duration split by ImageDecodeSizeSuffix() of
+  // |area|, the number of pixels being decoded.
+  void SetDecodedArea(uint64_t area) { decoded_area_ = area; }
+
  private:
   const DecodeType decode_type_;
   const TaskType task_type_;
+  uint64_t decoded_area_ = 0;
 };
 
 class CC_BASE_EXPORT ScopedLayerTreeTask {
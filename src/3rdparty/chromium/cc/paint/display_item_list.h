@@ -154,6 +154,15 @@ class CC_PAINT_EXPORT DisplayItemList
   }
   size_t OpBytesUsed() const { return paint_op_buffer_.paint_ops_size(); }
 
+  // Bytes of op storage recorded directly into this list, not counting
+  // sub-records.
+  size_t RecordedOpBytes() const { return paint_op_buffer_.next_op_offset(); }
+
+  // Pre-sizes the op storage before recording. A caller that re-records the
+  // same content can pass the previous list's RecordedOpBytes() so that the
+  // buffer doesn't have to grow and be copied repeatedly while recording.
+  void ReserveOpStorage(size_t bytes) { paint_op_buffer_.Reserve(bytes); }
+
   const DiscardableImageMap& discardable_image_map() const {
     return image_map_;
   }
@@ -455,6 +455,35 @@ TEST_F(DisplayItemListTest, BytesUsed) {
   EXPECT_LE(memory_usage, 2 * sizeof(DrawRectOp) * kNumPaintOps);
 }
 
+TEST_F(DisplayItemListTest, ReserveOpStorageFromPreviousRecording) {
+  const int kNumPaintOps = 100;
+  gfx::Rect layer_rect(100, 100);
+  PaintFlags blue_flags;
+  blue_flags.setColor(SK_ColorBLUE);
+
+  auto record = [&](DisplayItemList& list) {
+    list.StartPaint();
+    for (int i = 0; i < kNumPaintOps; i++)
+      list.push<DrawRectOp>(SkRect::MakeWH(1, 1), blue_flags);
+    list.EndPaintOfUnpaired(layer_rect);
+    list.Finalize();
+  };
+
+  auto previous = base::MakeRefCounted<DisplayItemList>();
+  record(*previous);
+  EXPECT_GE(previous->RecordedOpBytes(), sizeof(DrawRectOp) * kNumPaintOps);
+
+  // Recording the same content into a list reserved from the previous one
+  // fills the reservation exactly.
+  auto list = base::MakeRefCounted<DisplayItemList>();
+  list->ReserveOpStorage(previous->RecordedOpBytes());
+  size_t reserved_bytes = list->BytesUsed();
+  record(*list);
+  EXPECT_EQ(previous->RecordedOpBytes(), list->RecordedOpBytes());
+  EXPECT_EQ(reserved_bytes, list->BytesUsed());
+  EXPECT_EQ(previous->BytesUsed(), list->BytesUsed());
+}
+
 TEST_F(DisplayItemListTest, AsValueWithNoOps) {
   auto list = base::MakeRefCounted<DisplayItemList>();
   list->Finalize();
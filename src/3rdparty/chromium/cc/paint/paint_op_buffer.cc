@@ -361,6 +361,12 @@ void* PaintOpBuffer::AllocatePaintOp(uint16_t aligned_size) {
   return op;
 }
 
+void PaintOpBuffer::Reserve(size_t bytes) {
+  DCHECK(is_mutable());
+  if (bytes > reserved_)
+    ReallocBuffer(base::bits::AlignUp(bytes, kPaintOpAlign));
+}
+
 void PaintOpBuffer::ShrinkToFit() {
   ReallocIfNeededToFit();
 }
@@ -232,6 +232,11 @@ class CC_PAINT_EXPORT PaintOpBuffer : public SkRefCnt {
   bool NeedsAdditionalInvalidationForLCDText(
       const PaintOpBuffer& old_buffer) const;
 
+  // Makes sure at least |bytes| of op storage are allocated, so that a caller
+  // that knows roughly how much it will record (e.g. from the previous frame)
+  // can avoid repeatedly growing and copying the buffer.
+  void Reserve(size_t bytes);
+
   // Resize the PaintOpBuffer to exactly fit the current amount of used space.
   void ShrinkToFit();
 
@@ -4054,6 +4054,24 @@ TEST(PaintOpBufferTest, ShrinkToFit) {
   EXPECT_EQ(data_buffer, buffer.DataBufferForTesting());
 }
 
+TEST(PaintOpBufferTest, Reserve) {
+  PaintOpBuffer buffer;
+  buffer.Reserve(10000);
+  EXPECT_EQ(sizeof(PaintOpBuffer) + 10000, buffer.bytes_used());
+  const char* data_buffer = buffer.DataBufferForTesting();
+  ASSERT_TRUE(data_buffer);
+
+  // Recording within the reservation doesn't reallocate.
+  for (size_t i = 0; i < 10000 / sizeof(DrawColorOp); ++i)
+    buffer.push<DrawColorOp>(SkColors::kRed, SkBlendMode::kSrc);
+  EXPECT_EQ(data_buffer, buffer.DataBufferForTesting());
+
+  // Reserving less than what is already allocated is a no-op.
+  buffer.Reserve(100);
+  EXPECT_EQ(sizeof(PaintOpBuffer) + 10000, buffer.bytes_used());
+  EXPECT_EQ(data_buffer, buffer.DataBufferForTesting());
+}
+
 TEST(PaintOpBufferTest, ReleaseAsRecord) {
   PaintOpBuffer buffer;
   PaintRecord record = buffer.ReleaseAsRecord();
@@ -170,5 +170,65 @@ TEST_F(PaintOpPerfTest, TextOps) {
   RunTest("text", buffer);
 }
 
+// Recording into a fresh buffer that grows as ops are added, into a fresh
+// buffer pre-sized with Reserve() from a previous recording, as
+// ContentLayerClientImpl does, and into a buffer whose storage is retained
+// across ReleaseAsRecord().
+TEST_F(PaintOpPerfTest, RecordDrawOps) {
+  constexpr size_t kNumOps = 1000;
+  PaintFlags flags;
+
+  timer_.Reset();
+  do {
+    PaintOpBuffer buffer;
+    for (size_t i = 0; i < kNumOps; ++i)
+      buffer.push<DrawRectOp>(SkRect::MakeXYWH(1, 1, 1, 1), flags);
+    PaintRecord record = buffer.ReleaseAsRecord();
+    CHECK_EQ(kNumOps, record.size());
+    timer_.NextLap();
+  } while (!timer_.HasTimeLimitExpired());
+
+  perf_test::PerfResultReporter reporter("record", "fresh");
+  reporter.RegisterImportantMetric("", "runs/s");
+  reporter.AddResult("", timer_.LapsPerSecond());
+
+  size_t recorded_bytes = 0;
+  {
+    PaintOpBuffer buffer;
+    for (size_t i = 0; i < kNumOps; ++i)
+      buffer.push<DrawRectOp>(SkRect::MakeXYWH(1, 1, 1, 1), flags);
+    recorded_bytes = buffer.next_op_offset();
+  }
+
+  timer_.Reset();
+  do {
+    PaintOpBuffer buffer;
+    buffer.Reserve(recorded_bytes);
+    for (size_t i = 0; i < kNumOps; ++i)
+      buffer.push<DrawRectOp>(SkRect::MakeXYWH(1, 1, 1, 1), flags);
+    PaintRecord record = buffer.ReleaseAsRecord();
+    CHECK_EQ(kNumOps, record.size());
+    timer_.NextLap();
+  } while (!timer_.HasTimeLimitExpired());
+
+  reporter = perf_test::PerfResultReporter("record", "reserved");
+  reporter.RegisterImportantMetric("", "runs/s");
+  reporter.AddResult("", timer_.LapsPerSecond());
+
+  PaintOpBuffer buffer;
+  timer_.Reset();
+  do {
+    for (size_t i = 0; i < kNumOps; ++i)
+      buffer.push<DrawRectOp>(SkRect::MakeXYWH(1, 1, 1, 1), flags);
+    PaintRecord record = buffer.ReleaseAsRecord();
+    CHECK_EQ(kNumOps, record.size());
+    timer_.NextLap();
+  } while (!timer_.HasTimeLimitExpired());
+
+  reporter = perf_test::PerfResultReporter("record", "retained");
+  reporter.RegisterImportantMetric("", "runs/s");
+  reporter.AddResult("", timer_.LapsPerSecond());
+}
+
 }  // namespace
 }  // namespace cc
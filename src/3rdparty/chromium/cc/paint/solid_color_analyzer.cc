@@ -274,15 +274,29 @@ absl::optional<SkColor4f> SolidColorAnalyzer::DetermineIfSolidColor(
         continue;
       }
 
-      // Any of the following ops result in non solid content.
+      // Any of the following ops result in non solid content, unless they
+      // fall entirely outside of the analyzed rect. Display items are only
+      // culled by their visual rect, so large records routinely contain ops
+      // that don't touch a given tile.
       case PaintOpType::DrawDRRect:
       case PaintOpType::DrawImage:
       case PaintOpType::DrawImageRect:
-      case PaintOpType::DrawIRect:
       case PaintOpType::DrawLine:
       case PaintOpType::DrawOval:
       case PaintOpType::DrawPath:
-        return absl::nullopt;
+      case PaintOpType::DrawSlug:
+      case PaintOpType::DrawTextBlob:
+        if (++num_draw_ops > max_ops_to_analyze)
+          return absl::nullopt;
+        // Inverse fill paths cover everything outside their bounds, so their
+        // bounds can't be used to reject them.
+        if (op.GetType() == PaintOpType::DrawPath &&
+            static_cast<const DrawPathOp&>(op).path.isInverseFillType()) {
+          return absl::nullopt;
+        }
+        if (!PaintOp::QuickRejectDraw(op, &canvas))
+          return absl::nullopt;
+        break;
       // TODO(vmpstr): Add more tests on exceeding max_ops_to_analyze.
       case PaintOpType::DrawRRect: {
         if (++num_draw_ops > max_ops_to_analyze)
@@ -293,8 +307,6 @@ absl::optional<SkColor4f> SolidColorAnalyzer::DetermineIfSolidColor(
         break;
       }
       case PaintOpType::DrawSkottie:
-      case PaintOpType::DrawSlug:
-      case PaintOpType::DrawTextBlob:
       // Anything that has to do a save layer is probably not solid. As it will
       // likely need more than one draw op.
       // TODO(vmpstr): We could investigate handling these.
@@ -323,6 +335,14 @@ absl::optional<SkColor4f> SolidColorAnalyzer::DetermineIfSolidColor(
                           &is_transparent, &color);
         break;
       }
+      case PaintOpType::DrawIRect: {
+        if (++num_draw_ops > max_ops_to_analyze)
+          return absl::nullopt;
+        const auto& rect_op = static_cast<const DrawIRectOp&>(op);
+        CheckIfSolidShape(canvas, SkRect::Make(rect_op.rect), rect_op.flags,
+                          &is_solid, &is_transparent, &color);
+        break;
+      }
       case PaintOpType::DrawColor: {
         if (++num_draw_ops > max_ops_to_analyze)
           return absl::nullopt;
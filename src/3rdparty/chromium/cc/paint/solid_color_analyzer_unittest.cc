@@ -84,6 +84,54 @@ TEST_F(SolidColorAnalyzerTest, DrawOval) {
   EXPECT_FALSE(IsSolidColor());
 }
 
+TEST_F(SolidColorAnalyzerTest, DrawOvalOutsideRect) {
+  SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
+  canvas_.drawColor(color);
+  PaintFlags flags;
+  flags.setColor(SkColors::kRed);
+  canvas_.drawOval(SkRect::MakeXYWH(150, 150, 50, 50), flags);
+  EXPECT_EQ(color, GetColor(2 /* max_ops_to_analyze */));
+}
+
+TEST_F(SolidColorAnalyzerTest, DrawOvalOutsideRectExceedsMaxOps) {
+  SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
+  canvas_.drawColor(color);
+  PaintFlags flags;
+  flags.setColor(SkColors::kRed);
+  canvas_.drawOval(SkRect::MakeXYWH(150, 150, 50, 50), flags);
+  EXPECT_FALSE(IsSolidColor(1 /* max_ops_to_analyze */));
+}
+
+TEST_F(SolidColorAnalyzerTest, DrawPathOutsideRect) {
+  SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
+  canvas_.drawColor(color);
+  PaintFlags flags;
+  flags.setColor(SkColors::kRed);
+  canvas_.drawPath(SkPath::Rect(SkRect::MakeXYWH(150, 150, 50, 50)), flags);
+  EXPECT_EQ(color, GetColor(2 /* max_ops_to_analyze */));
+}
+
+TEST_F(SolidColorAnalyzerTest, DrawInverseFillPathOutsideRect) {
+  SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
+  canvas_.drawColor(color);
+  PaintFlags flags;
+  flags.setColor(SkColors::kRed);
+  // The path's bounds are outside the rect, but an inverse fill covers
+  // everything else, including the whole rect.
+  SkPath path = SkPath::Rect(SkRect::MakeXYWH(150, 150, 50, 50));
+  path.setFillType(SkPathFillType::kInverseWinding);
+  canvas_.drawPath(path, flags);
+  EXPECT_FALSE(IsSolidColor(2 /* max_ops_to_analyze */));
+}
+
+TEST_F(SolidColorAnalyzerTest, DrawIRect) {
+  PaintFlags flags;
+  SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
+  flags.setColor(color);
+  canvas_.drawIRect(SkIRect::MakeWH(200, 200), flags);
+  EXPECT_EQ(color, GetColor());
+}
+
 TEST_F(SolidColorAnalyzerTest, DrawRect) {
   PaintFlags flags;
   SkColor4f color = SkColor4f::FromColor(SkColorSetARGB(255, 11, 22, 33));
@@ -10,6 +10,7 @@
 
 #include "base/containers/contains.h"
 #include "base/functional/bind.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/ranges/algorithm.h"
 #include "base/strings/stringprintf.h"
 #include "base/task/sequenced_task_runner.h"
@@ -158,7 +159,8 @@ void StagingBufferPool::Shutdown() {
   if (buffers_.empty())
     return;
 
-  ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max());
+  ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max(),
+                             /*release_busy_buffers=*/true);
   DCHECK_EQ(staging_buffer_usage_in_bytes_, 0);
   DCHECK_EQ(free_staging_buffer_usage_in_bytes_, 0);
 }
@@ -184,6 +186,10 @@ bool StagingBufferPool::OnMemoryDump(
     dump->AddScalar(MemoryAllocatorDump::kNameSize,
                     MemoryAllocatorDump::kUnitsBytes,
                     staging_buffer_usage_in_bytes_);
+    // Memory held by buffers that are idle in the pool, as opposed to buffers
+    // with a copy in flight.
+    dump->AddScalar("free_size", MemoryAllocatorDump::kUnitsBytes,
+                    free_staging_buffer_usage_in_bytes_);
   } else {
     for (const auto* buffer : buffers_) {
       buffer->OnMemoryDump(
@@ -305,6 +311,9 @@ std::unique_ptr<StagingBuffer> StagingBufferPool::AcquireStagingBuffer(
     }
   }
 
+  UMA_HISTOGRAM_BOOLEAN("Compositing.Renderer.StagingBufferPool.Reused",
+                        !!staging_buffer);
+
   // Create new staging buffer if necessary.
   if (!staging_buffer) {
     staging_buffer = std::make_unique<StagingBuffer>(size, format);
@@ -359,7 +368,8 @@ void StagingBufferPool::ReduceMemoryUsage() {
     return;
 
   base::TimeTicks current_time = base::TimeTicks::Now();
-  ReleaseBuffersNotUsedSince(current_time - staging_buffer_expiration_delay_);
+  ReleaseBuffersNotUsedSince(current_time - staging_buffer_expiration_delay_,
+                             /*release_busy_buffers=*/true);
 
   if (free_buffers_.empty() && busy_buffers_.empty())
     return;
@@ -374,7 +384,8 @@ void StagingBufferPool::ReduceMemoryUsage() {
                                 reduce_memory_usage_time - current_time);
 }
 
-void StagingBufferPool::ReleaseBuffersNotUsedSince(base::TimeTicks time) {
+void StagingBufferPool::ReleaseBuffersNotUsedSince(base::TimeTicks time,
+                                                   bool release_busy_buffers) {
   {
     viz::RasterContextProvider::ScopedRasterContextLock scoped_context(
         worker_context_provider_);
@@ -399,7 +410,7 @@ void StagingBufferPool::ReleaseBuffersNotUsedSince(base::TimeTicks time) {
       free_buffers_.pop_front();
     }
 
-    while (!busy_buffers_.empty()) {
+    while (release_busy_buffers && !busy_buffers_.empty()) {
       if (busy_buffers_.front()->last_usage > time)
         break;
 
@@ -421,11 +432,18 @@ void StagingBufferPool::OnMemoryPressure(
   base::AutoLock lock(lock_);
   switch (level) {
     case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_NONE:
+      break;
     case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE:
+      // Release idle buffers right away instead of waiting for them to
+      // expire. Busy buffers still have a copy in flight and are released by
+      // the regular expiration.
+      ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max(),
+                                 /*release_busy_buffers=*/false);
       break;
     case base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_CRITICAL:
       // Release all buffers, regardless of how recently they were used.
-      ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max());
+      ReleaseBuffersNotUsedSince(base::TimeTicks() + base::TimeDelta::Max(),
+                                 /*release_busy_buffers=*/true);
       break;
   }
 }
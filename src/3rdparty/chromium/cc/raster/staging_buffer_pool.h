@@ -102,6 +102,15 @@ class CC_EXPORT StagingBufferPool final
       uint64_t previous_content_id);
   void ReleaseStagingBuffer(std::unique_ptr<StagingBuffer> staging_buffer);
 
+  size_t free_buffer_count_for_testing() const {
+    base::AutoLock lock(lock_);
+    return free_buffers_.size();
+  }
+  size_t busy_buffer_count_for_testing() const {
+    base::AutoLock lock(lock_);
+    return busy_buffers_.size();
+  }
+
  private:
   void AddStagingBuffer(const StagingBuffer* staging_buffer,
                         viz::ResourceFormat format)
@@ -116,7 +125,10 @@ class CC_EXPORT StagingBufferPool final
   base::TimeTicks GetUsageTimeForLRUBuffer() EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void ScheduleReduceMemoryUsage() EXCLUSIVE_LOCKS_REQUIRED(lock_);
   void ReduceMemoryUsage();
-  void ReleaseBuffersNotUsedSince(base::TimeTicks time)
+  // Releases free buffers, and busy ones if |release_busy_buffers| is true,
+  // that haven't been used since |time|.
+  void ReleaseBuffersNotUsedSince(base::TimeTicks time,
+                                  bool release_busy_buffers)
       EXCLUSIVE_LOCKS_REQUIRED(lock_);
 
   std::unique_ptr<base::trace_event::ConvertableToTraceFormat> StateAsValue()
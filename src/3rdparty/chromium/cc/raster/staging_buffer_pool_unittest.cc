@@ -7,6 +7,7 @@
 #include "base/run_loop.h"
 #include "base/task/single_thread_task_runner.h"
 #include "base/test/task_environment.h"
+#include "components/viz/common/resources/resource_sizes.h"
 #include "components/viz/test/test_context_provider.h"
 #include "testing/gtest/include/gtest/gtest.h"
 
@@ -44,4 +45,54 @@ TEST(StagingBufferPoolTest, ShutdownImmediatelyAfterCreation) {
   // No crash.
 }
 
+TEST(StagingBufferPoolTest, ModerateMemoryPressureReleasesFreeBuffers) {
+  auto context_provider = viz::TestContextProvider::CreateWorker();
+  auto task_runner = base::SingleThreadTaskRunner::GetCurrentDefault();
+  const gfx::Size large_size(16, 16);
+  const gfx::Size medium_size(8, 8);
+  const gfx::Size small_size(4, 4);
+  // Allow only the largest buffer to be in use, so that acquiring past it
+  // reclaims the busy buffers.
+  const int max_staging_buffer_usage_in_bytes =
+      viz::ResourceSizes::UncheckedSizeInBytes<int>(large_size,
+                                                    viz::RGBA_8888);
+  auto pool = std::make_unique<StagingBufferPool>(
+      task_runner.get(), context_provider.get(),
+      /*use_partial_raster=*/false, max_staging_buffer_usage_in_bytes);
+  auto flush_message_loop = [] {
+    base::RunLoop runloop;
+    base::SingleThreadTaskRunner::GetCurrentDefault()->PostTask(
+        FROM_HERE, runloop.QuitClosure());
+    runloop.Run();
+  };
+  // Let the pool register as a memory pressure observer.
+  flush_message_loop();
+
+  // Use and return a large and a medium buffer. They stay busy, since no
+  // query tracks their use.
+  auto large = pool->AcquireStagingBuffer(large_size, viz::RGBA_8888, 0);
+  auto medium = pool->AcquireStagingBuffer(medium_size, viz::RGBA_8888, 0);
+  pool->ReleaseStagingBuffer(std::move(large));
+  pool->ReleaseStagingBuffer(std::move(medium));
+  EXPECT_EQ(0u, pool->free_buffer_count_for_testing());
+  EXPECT_EQ(2u, pool->busy_buffer_count_for_testing());
+
+  // Acquiring a small buffer goes over the limit. That waits for the busy
+  // buffers to become free, then evicts the large one to make room. The
+  // medium buffer is left free, and the small one is busy once returned.
+  auto small = pool->AcquireStagingBuffer(small_size, viz::RGBA_8888, 0);
+  pool->ReleaseStagingBuffer(std::move(small));
+  EXPECT_EQ(1u, pool->free_buffer_count_for_testing());
+  EXPECT_EQ(1u, pool->busy_buffer_count_for_testing());
+
+  // Moderate pressure releases the free buffer and keeps the busy one.
+  base::MemoryPressureListener::SimulatePressureNotification(
+      base::MemoryPressureListener::MEMORY_PRESSURE_LEVEL_MODERATE);
+  flush_message_loop();
+  EXPECT_EQ(0u, pool->free_buffer_count_for_testing());
+  EXPECT_EQ(1u, pool->busy_buffer_count_for_testing());
+
+  pool->Shutdown();
+}
+
 }  // namespace cc
@@ -204,6 +204,45 @@ class TaskGraphRunnerPerfTest : public testing::Test {
                        timer_.LapsPerSecond());
   }
 
+  // Like RunScheduleAndExecuteTasksTest(), but spreads |num_tasks| over
+  // |num_categories| categories. Every task depends on all leaf tasks, so
+  // completing the last leaf task makes tasks ready in every category at once.
+  // Rescheduling the same tasks each lap also matches the whole previous graph
+  // against the new one.
+  void RunScheduleAndExecuteCategorizedTasksTest(const std::string& test_name,
+                                                 uint16_t num_categories,
+                                                 int num_tasks,
+                                                 int num_leaf_tasks) {
+    PerfTaskImpl::Vector tasks;
+    PerfTaskImpl::Vector leaf_tasks;
+    CreateTasks(num_tasks, &tasks);
+    CreateTasks(num_leaf_tasks, &leaf_tasks);
+
+    // Avoid unnecessary heap allocations by reusing the same graph and
+    // completed tasks vector.
+    TaskGraph graph;
+    Task::Vector completed_tasks;
+
+    timer_.Reset();
+    do {
+      graph.Reset();
+      // Tasks run have finished state. Reset them to be considered as new for
+      // scheduling again.
+      ResetTasks(tasks);
+      ResetTasks(leaf_tasks);
+      BuildCategorizedTaskGraph(tasks, leaf_tasks, num_categories, &graph);
+      task_graph_runner_->ScheduleTasks(namespace_token_, &graph);
+      task_graph_runner_->RunUntilIdle();
+      CollectCompletedTasks(&completed_tasks);
+      completed_tasks.clear();
+      timer_.NextLap();
+    } while (!timer_.HasTimeLimitExpired());
+
+    perf_test::PerfResultReporter reporter = SetUpReporter(test_name);
+    reporter.AddResult("execute_categorized_tasks" + TestModifierString(),
+                       timer_.LapsPerSecond());
+  }
+
  private:
   static std::string TestModifierString() {
     return std::string("_task_graph_runner");
@@ -250,6 +289,26 @@ class TaskGraphRunnerPerfTest : public testing::Test {
       graph->nodes.emplace_back(top_level_task, 0u, 0u, task_count);
   }
 
+  void BuildCategorizedTaskGraph(const PerfTaskImpl::Vector& tasks,
+                                 const PerfTaskImpl::Vector& leaf_tasks,
+                                 uint16_t num_categories,
+                                 TaskGraph* graph) {
+    DCHECK(graph->nodes.empty());
+    DCHECK(graph->edges.empty());
+
+    uint32_t leaf_task_count = static_cast<uint32_t>(leaf_tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+      for (const auto& leaf_task : leaf_tasks)
+        graph->edges.emplace_back(leaf_task.get(), tasks[i].get());
+
+      uint16_t category = static_cast<uint16_t>(i % num_categories);
+      graph->nodes.emplace_back(tasks[i], category, 0u, leaf_task_count);
+    }
+
+    for (auto& leaf_task : leaf_tasks)
+      graph->nodes.emplace_back(leaf_task, 0u, 0u, 0u);
+  }
+
   size_t CollectCompletedTasks(Task::Vector* completed_tasks) {
     DCHECK(completed_tasks->empty());
     task_graph_runner_->CollectCompletedTasks(namespace_token_,
@@ -267,6 +326,8 @@ class TaskGraphRunnerPerfTest : public testing::Test {
         "schedule_alternate_tasks" + TestModifierString(), "runs/s");
     reporter.RegisterImportantMetric("execute_tasks" + TestModifierString(),
                                      "runs/s");
+    reporter.RegisterImportantMetric(
+        "execute_categorized_tasks" + TestModifierString(), "runs/s");
     return reporter;
   }
 
@@ -313,5 +374,14 @@ TEST_F(TaskGraphRunnerPerfTest, ScheduleAndExecuteTasks) {
   RunScheduleAndExecuteTasksTest("2_32_1", 2, 32, 1);
 }
 
+// Story names are <categories>_<tasks>_<leaf tasks>.
+TEST_F(TaskGraphRunnerPerfTest, ScheduleAndExecuteCategorizedTasks) {
+  RunScheduleAndExecuteCategorizedTasksTest("1_32_1", 1, 32, 1);
+  RunScheduleAndExecuteCategorizedTasksTest("4_32_1", 4, 32, 1);
+  RunScheduleAndExecuteCategorizedTasksTest("1_512_1", 1, 512, 1);
+  RunScheduleAndExecuteCategorizedTasksTest("4_512_1", 4, 512, 1);
+  RunScheduleAndExecuteCategorizedTasksTest("4_512_8", 4, 512, 8);
+}
+
 }  // namespace
 }  // namespace cc
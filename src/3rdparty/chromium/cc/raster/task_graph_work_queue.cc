@@ -9,9 +9,12 @@
 
 #include <map>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "base/containers/contains.h"
+#include "base/containers/cxx20_erase_vector.h"
 #include "base/memory/raw_ptr_exclusion.h"
 #include "base/ranges/algorithm.h"
 #include "base/trace_event/trace_event.h"
@@ -149,26 +152,35 @@ void TaskGraphWorkQueue::ScheduleTasks(NamespaceToken token, TaskGraph* graph) {
     }
   }
 
-  // Build new "ready to run" queue and remove nodes from old graph.
+  // Remove any old nodes that are associated with a task in the new graph.
+  // The result is that the old graph is left with all nodes not present in
+  // this graph, which we use below to determine what tasks need to be
+  // canceled. This runs under the task graph runner's lock, so look tasks up
+  // in a set rather than searching the old graph once per new node.
+  if (!task_namespace.graph.nodes.empty()) {
+    std::unordered_set<const Task*> new_tasks;
+    new_tasks.reserve(graph->nodes.size());
+    for (const TaskGraph::Node& node : graph->nodes)
+      new_tasks.insert(node.task.get());
+    base::EraseIf(task_namespace.graph.nodes,
+                  [&new_tasks](const TaskGraph::Node& old_node) {
+                    if (!base::Contains(new_tasks, old_node.task.get()))
+                      return false;
+                    // If old task is scheduled to run again and not yet
+                    // started running, reset its state to initial state as it
+                    // has to be inserted in new |ready_to_run_tasks|, where it
+                    // gets scheduled.
+                    if (old_node.task->state().IsScheduled())
+                      old_node.task->state().Reset();
+                    return true;
+                  });
+  }
+
+  // Build new "ready to run" queue.
   for (auto& ready_to_run_tasks_it : task_namespace.ready_to_run_tasks) {
     ready_to_run_tasks_it.second.clear();
   }
   for (const TaskGraph::Node& node : graph->nodes) {
-    // Remove any old nodes that are associated with this task. The result is
-    // that the old graph is left with all nodes not present in this graph,
-    // which we use below to determine what tasks need to be canceled.
-    auto old_it = base::ranges::find(task_namespace.graph.nodes, node.task,
-                                     &TaskGraph::Node::task);
-    if (old_it != task_namespace.graph.nodes.end()) {
-      std::swap(*old_it, task_namespace.graph.nodes.back());
-      // If old task is scheduled to run again and not yet started running,
-      // reset its state to initial state as it has to be inserted in new
-      // |ready_to_run_tasks|, where it gets scheduled.
-      if (node.task->state().IsScheduled())
-        node.task->state().Reset();
-      task_namespace.graph.nodes.pop_back();
-    }
-
     // Task is not ready to run if dependencies are not yet satisfied.
     if (node.dependencies)
       continue;
@@ -296,8 +308,10 @@ void TaskGraphWorkQueue::CompleteTask(PrioritizedTask completed_task) {
   task_namespace->running_tasks.pop_back();
 
   // Now iterate over all dependents to decrement dependencies and check if they
-  // are ready to run.
-  bool ready_to_run_namespaces_has_heap_properties = true;
+  // are ready to run. Only the categories that received new tasks lose their
+  // heap properties; there are only a handful of categories, so a vector is
+  // enough to track them.
+  std::vector<uint16_t> categories_to_reheap;
   for (DependentIterator dependent_it(&task_namespace->graph, task.get());
        dependent_it; ++dependent_it) {
     TaskGraph::Node& dependent_node = *dependent_it;
@@ -327,20 +341,18 @@ void TaskGraphWorkQueue::CompleteTask(PrioritizedTask completed_task) {
         DCHECK(!base::Contains(ready_to_run_namespaces, task_namespace));
         ready_to_run_namespaces.push_back(task_namespace);
       }
-      ready_to_run_namespaces_has_heap_properties = false;
+      if (!base::Contains(categories_to_reheap, dependent_node.category))
+        categories_to_reheap.push_back(dependent_node.category);
     }
   }
 
   // Rearrange the task namespaces in |ready_to_run_namespaces_| in such a way
   // that they yet again form a heap.
-  if (!ready_to_run_namespaces_has_heap_properties) {
-    for (auto& ready_to_run_it : ready_to_run_namespaces_) {
-      uint16_t category = ready_to_run_it.first;
-      auto& ready_to_run_namespaces = ready_to_run_it.second;
-      std::make_heap(ready_to_run_namespaces.begin(),
-                     ready_to_run_namespaces.end(),
-                     CompareTaskNamespacePriority(category));
-    }
+  for (uint16_t category : categories_to_reheap) {
+    auto& ready_to_run_namespaces = ready_to_run_namespaces_[category];
+    std::make_heap(ready_to_run_namespaces.begin(),
+                   ready_to_run_namespaces.end(),
+                   CompareTaskNamespacePriority(category));
   }
 
   // Finally add task to |completed_tasks|.
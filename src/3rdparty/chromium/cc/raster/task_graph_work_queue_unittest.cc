@@ -217,5 +217,44 @@ TEST(TaskGraphWorkQueueTest, TestTaskWithDifferentPriority) {
   }
 }
 
+// Rescheduling keeps tasks that are still in the graph and cancels the rest.
+TEST(TaskGraphWorkQueueTest, TestReschedulePartiallyOverlappingGraph) {
+  TaskGraphWorkQueue work_queue;
+  NamespaceToken token = work_queue.GenerateNamespaceToken();
+
+  scoped_refptr<FakeTaskImpl> dropped_task(new FakeTaskImpl());
+  scoped_refptr<FakeTaskImpl> kept_task(new FakeTaskImpl());
+  scoped_refptr<FakeTaskImpl> new_task(new FakeTaskImpl());
+
+  TaskGraph graph1;
+  graph1.nodes.push_back(TaskGraph::Node(dropped_task.get(), 0u, 0u, 0u));
+  graph1.nodes.push_back(TaskGraph::Node(kept_task.get(), 0u, 1u, 0u));
+  work_queue.ScheduleTasks(token, &graph1);
+  EXPECT_EQ(2u, work_queue.NumReadyTasksForCategory(0u));
+
+  TaskGraph graph2;
+  graph2.nodes.push_back(TaskGraph::Node(kept_task.get(), 0u, 1u, 0u));
+  graph2.nodes.push_back(TaskGraph::Node(new_task.get(), 0u, 0u, 0u));
+  work_queue.ScheduleTasks(token, &graph2);
+
+  // |dropped_task| is canceled and reported as completed.
+  Task::Vector completed_tasks;
+  work_queue.CollectCompletedTasks(token, &completed_tasks);
+  ASSERT_EQ(1u, completed_tasks.size());
+  EXPECT_EQ(dropped_task.get(), completed_tasks[0].get());
+  EXPECT_TRUE(dropped_task->state().IsCanceled());
+
+  // |kept_task| is rescheduled alongside |new_task|, in priority order.
+  EXPECT_EQ(2u, work_queue.NumReadyTasksForCategory(0u));
+  TaskGraphWorkQueue::PrioritizedTask prioritized_task =
+      work_queue.GetNextTaskToRun(0u);
+  EXPECT_EQ(new_task.get(), prioritized_task.task.get());
+  work_queue.CompleteTask(std::move(prioritized_task));
+  prioritized_task = work_queue.GetNextTaskToRun(0u);
+  EXPECT_EQ(kept_task.get(), prioritized_task.task.get());
+  work_queue.CompleteTask(std::move(prioritized_task));
+  EXPECT_FALSE(work_queue.HasReadyToRunTasks());
+}
+
 }  // namespace
 }  // namespace cc
@@ -611,7 +611,9 @@ class GpuImageDecodeTaskImpl : public TileTask {
         devtools_instrumentation::ScopedImageDecodeTask::kGpu,
         ImageDecodeCache::ToScopedTaskType(tracing_info_.task_type),
         ImageDecodeCache::ToScopedImageType(image_type));
-    cache_->DecodeImageInTask(image_, tracing_info_.task_type);
+    gfx::Size decoded_size =
+        cache_->DecodeImageInTask(image_, tracing_info_.task_type);
+    image_decode_task.SetDecodedArea(decoded_size.Area64());
   }
 
   // Overridden from TileTask:
@@ -1673,8 +1675,8 @@ bool GpuImageDecodeCache::OnMemoryDump(
   return true;
 }
 
-void GpuImageDecodeCache::DecodeImageInTask(const DrawImage& draw_image,
-                                            TaskType task_type) {
+gfx::Size GpuImageDecodeCache::DecodeImageInTask(const DrawImage& draw_image,
+                                                 TaskType task_type) {
   TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("cc.debug"),
                "GpuImageDecodeCache::DecodeImage");
   base::AutoLock lock(lock_);
@@ -1684,6 +1686,8 @@ void GpuImageDecodeCache::DecodeImageInTask(const DrawImage& draw_image,
   DCHECK(image_data->is_budgeted) << "Must budget an image for pre-decoding";
   DecodeImageAndGenerateDarkModeFilterIfNecessary(draw_image, image_data,
                                                   task_type);
+  return CalculateSizeForMipLevel(draw_image,
+                                  image_data->upload_scale_mip_level);
 }
 
 void GpuImageDecodeCache::UploadImageInTask(const DrawImage& draw_image) {
@@ -28,6 +28,7 @@
 #include "third_party/skia/include/core/SkRefCnt.h"
 #include "third_party/skia/include/core/SkYUVAInfo.h"
 #include "third_party/skia/include/gpu/gl/GrGLTypes.h"
+#include "ui/gfx/geometry/size.h"
 
 namespace viz {
 class RasterContextProvider;
@@ -186,8 +187,9 @@ class CC_EXPORT GpuImageDecodeCache
   void OnMemoryPressure(
       base::MemoryPressureListener::MemoryPressureLevel level);
 
-  // Called by Decode / Upload tasks.
-  void DecodeImageInTask(const DrawImage& image, TaskType task_type);
+  // Called by Decode / Upload tasks. DecodeImageInTask returns the size
+  // |image| is decoded at.
+  gfx::Size DecodeImageInTask(const DrawImage& image, TaskType task_type);
   void UploadImageInTask(const DrawImage& image);
 
   // Called by Decode / Upload tasks when tasks are finished.
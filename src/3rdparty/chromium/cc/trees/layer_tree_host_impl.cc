@@ -1361,6 +1361,8 @@ DrawResult LayerTreeHostImpl::CalculateRenderPasses(FrameData* frame) {
   int num_missing_tiles = 0;
   int num_incomplete_tiles = 0;
   int64_t checkerboarded_no_recording_content_area = 0;
+  int64_t checkerboarded_visible_content_area = 0;
+  int64_t visible_layer_area = 0;
 
   bool have_copy_request =
       active_tree()->property_trees()->effect_tree().HasCopyRequests();
@@ -1428,6 +1430,9 @@ DrawResult LayerTreeHostImpl::CalculateRenderPasses(FrameData* frame) {
       num_incomplete_tiles += append_quads_data.num_incomplete_tiles;
       checkerboarded_no_recording_content_area +=
           append_quads_data.checkerboarded_no_recording_content_area;
+      checkerboarded_visible_content_area +=
+          append_quads_data.checkerboarded_visible_content_area;
+      visible_layer_area += append_quads_data.visible_layer_area;
 
       if (append_quads_data.num_missing_tiles > 0) {
         have_missing_animated_tiles |=
@@ -1452,9 +1457,22 @@ DrawResult LayerTreeHostImpl::CalculateRenderPasses(FrameData* frame) {
         append_quads_data.has_shared_element_resources;
   }
 
-  if (GetActivelyScrollingType() != ActivelyScrollingType::kNone &&
-      checkerboarded_no_recording_content_area > 0) {
-    SetCurrentScrollCheckerboardsDueToNoRecording();
+  if (GetActivelyScrollingType() != ActivelyScrollingType::kNone) {
+    if (checkerboarded_no_recording_content_area > 0)
+      SetCurrentScrollCheckerboardsDueToNoRecording();
+
+    // Per-frame checkerboarding while scrolling (including flings) is the
+    // signal used to tune the skewport and tile prioritization.
+    TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("cc.debug"),
+                   "CheckerboardedVisibleContentArea",
+                   base::saturated_cast<int>(
+                       checkerboarded_visible_content_area));
+    if (visible_layer_area > 0) {
+      UMA_HISTOGRAM_PERCENTAGE(
+          "Compositing.Renderer.CheckerboardedAreaPercentDuringScroll",
+          base::saturated_cast<int>(checkerboarded_visible_content_area * 100 /
+                                    visible_layer_area));
+    }
   }
 
   // If CommitToActiveTree() is true, then we wait to draw until
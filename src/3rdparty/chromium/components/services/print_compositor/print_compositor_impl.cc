@@ -10,8 +10,10 @@
 #include "base/containers/contains.h"
 #include "base/logging.h"
 #include "base/memory/discardable_memory.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/ranges/algorithm.h"
 #include "base/task/single_thread_task_runner.h"
+#include "base/timer/elapsed_timer.h"
 #include "base/trace_event/trace_event.h"
 #include "build/build_config.h"
 #include "components/crash/core/common/crash_key.h"
@@ -361,6 +363,7 @@ mojom::PrintCompositor::Status PrintCompositorImpl::CompositeToPdf(
 
   for (const auto& page : pages) {
     TRACE_EVENT0("print", "PrintCompositorImpl::CompositeToPdf draw page");
+    base::ElapsedTimer page_timer;
     SkCanvas* canvas = doc->beginPage(page.fSize.width(), page.fSize.height());
     canvas->drawPicture(page.fPicture);
     doc->endPage();
@@ -378,6 +381,8 @@ mojom::PrintCompositor::Status PrintCompositorImpl::CompositeToPdf(
       docinfo_->doc->endPage();
       docinfo_->pages_written++;
     }
+    base::UmaHistogramTimes("Printing.PrintCompositor.PageCompositeTime",
+                            page_timer.Elapsed());
   }
   doc->close();
 
@@ -936,6 +936,8 @@ bool VisitedLinkWriter::ResizeTableIfNecessary() {
 }
 
 void VisitedLinkWriter::ResizeTable(int32_t new_size) {
+  TRACE_EVENT2("browser", "VisitedLinkWriter::ResizeTable", "old_size",
+               table_length_, "new_size", new_size);
   DCHECK(mapped_table_memory_.region.IsValid() &&
          mapped_table_memory_.mapping.IsValid());
   shared_memory_serial_++;
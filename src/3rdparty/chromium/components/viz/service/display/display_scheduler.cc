@@ -504,6 +504,17 @@ void DisplayScheduler::OnBeginFrameDeadline() {
   TRACE_EVENT0("viz", "DisplayScheduler::OnBeginFrameDeadline");
   DCHECK(inside_begin_frame_deadline_interval_);
 
+  // Reaching the deadline with surfaces still pending means at least one
+  // client didn't submit in time and the display drew without it. The
+  // offending surface is named by DisplayDamageTracker::HasPendingSurfaces.
+  if (has_pending_surfaces_) {
+    TRACE_EVENT_INSTANT0("viz", "Deadline reached with pending surfaces",
+                         TRACE_EVENT_SCOPE_THREAD);
+  }
+  UMA_HISTOGRAM_BOOLEAN(
+      "Compositing.Display.DeadlineReachedWithPendingSurfaces",
+      has_pending_surfaces_);
+
   bool did_draw = AttemptDrawAndSwap();
   DidFinishFrame(did_draw);
 }
@@ -985,11 +985,17 @@ int ContentMainRunnerImpl::Initialize(ContentMainParams params) {
     }
   }
 #else
-  if (!base::i18n::InitializeICU())
-    return TerminateForFatalInitializationError();
+  {
+    TRACE_EVENT0("startup", "InitializeICU");
+    if (!base::i18n::InitializeICU())
+      return TerminateForFatalInitializationError();
+  }
 #endif  // BUILDFLAG(IS_ANDROID) && (ICU_UTIL_DATA_IMPL == ICU_UTIL_DATA_FILE)
 
-  LoadV8SnapshotIfNeeded(command_line, process_type);
+  {
+    TRACE_EVENT0("startup", "LoadV8SnapshotIfNeeded");
+    LoadV8SnapshotIfNeeded(command_line, process_type);
+  }
 
   blink::TrialTokenValidator::SetOriginTrialPolicyGetter(
       base::BindRepeating([]() -> blink::OriginTrialPolicy* {
@@ -1017,7 +1023,10 @@ int ContentMainRunnerImpl::Initialize(ContentMainParams params) {
   base::debug::VerifyDebugger();
 #endif  // !defined(OFFICIAL_BUILD)
 
-  delegate_->PreSandboxStartup();
+  {
+    TRACE_EVENT0("startup", "ContentMainDelegate::PreSandboxStartup");
+    delegate_->PreSandboxStartup();
+  }
 
 #if BUILDFLAG(IS_WIN)
   if (!sandbox::policy::Sandbox::Initialize(
@@ -1033,7 +1042,10 @@ int ContentMainRunnerImpl::Initialize(ContentMainParams params) {
   }
 #endif
 
-  delegate_->SandboxInitialized(process_type);
+  {
+    TRACE_EVENT0("startup", "ContentMainDelegate::SandboxInitialized");
+    delegate_->SandboxInitialized(process_type);
+  }
 
 #if BUILDFLAG(USE_ZYGOTE)
   if (process_type.empty()) {
@@ -1162,6 +1174,7 @@ int ContentMainRunnerImpl::RunBrowser(MainFunctionParams main_params,
     const ContentMainDelegate::InvokedInBrowserProcess invoked_in_browser{
         .is_running_test = !main_params.ui_task.is_null()};
     if (delegate_->ShouldCreateFeatureList(invoked_in_browser)) {
+      TRACE_EVENT0("startup", "SetUpFieldTrialsAndFeatureList");
       // This is intentionally leaked since it needs to live for the duration
       // of the process and there's no benefit in cleaning it up at exit.
       base::FieldTrialList* leaked_field_trial_list =
@@ -1171,6 +1184,7 @@ int ContentMainRunnerImpl::RunBrowser(MainFunctionParams main_params,
     }
 
     if (delegate_->ShouldInitializeMojo(invoked_in_browser)) {
+      TRACE_EVENT0("startup", "InitializeMojoCore");
       InitializeMojoCore();
     }
 
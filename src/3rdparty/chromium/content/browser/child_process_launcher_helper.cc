@@ -16,6 +16,7 @@
 #include "base/task/single_thread_task_runner.h"
 #include "base/task/single_thread_task_runner_thread_mode.h"
 #include "base/task/task_traits.h"
+#include "base/trace_event/trace_event.h"
 #include "build/build_config.h"
 #include "content/browser/child_process_launcher.h"
 #include "content/public/browser/browser_task_traits.h"
@@ -179,8 +180,13 @@ void ChildProcessLauncherHelper::PostLaunchOnLauncherThread(
     mojo_channel_->RemoteProcessLaunchAttempted();
 
   if (process.process.IsValid()) {
-    RecordHistogramsOnLauncherThread(base::TimeTicks::Now() -
-                                     begin_launch_time_);
+    const base::TimeTicks end_launch_time = base::TimeTicks::Now();
+    RecordHistogramsOnLauncherThread(end_launch_time - begin_launch_time_);
+    TRACE_EVENT_NESTABLE_ASYNC_BEGIN_WITH_TIMESTAMP1(
+        "startup", "ChildProcessLauncher::Launch", this, begin_launch_time_,
+        "process_type", GetProcessType());
+    TRACE_EVENT_NESTABLE_ASYNC_END_WITH_TIMESTAMP0(
+        "startup", "ChildProcessLauncher::Launch", this, end_launch_time);
   }
 
   // Take ownership of the broker client invitation here so it's destroyed when
@@ -15,6 +15,7 @@
 #include "base/i18n/file_util_icu.h"
 #include "base/logging.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/field_trial_params.h"
 #include "base/rand_util.h"
 #include "base/strings/string_piece.h"
 #include "base/strings/string_split.h"
@@ -45,6 +46,7 @@
 #include "content/browser/renderer_host/render_process_host_impl.h"
 #include "content/browser/renderer_host/render_view_host_delegate.h"
 #include "content/browser/renderer_host/render_view_host_impl.h"
+#include "content/common/features.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/browser_thread.h"
 #include "content/public/browser/content_browser_client.h"
@@ -95,6 +97,19 @@ const uint32_t kMaxFilePathLength = PATH_MAX - 1;
 // should be "(9998)", so the value is 6.
 const uint32_t kMaxFileOrdinalNumberPartLength = 6;
 
+// Maximum number of sub-resources of a complete HTML page that are fetched
+// from the network at the same time. The default matches the usual per-host
+// connection limit, so a page with many resources doesn't wait for each one
+// to finish before fetching the next.
+const base::FeatureParam<int> kMaxConcurrentNetSaveItems{
+    &kSavePackageConcurrentFetches, "max_in_flight", 6};
+
+int GetMaxConcurrentNetSaveItems() {
+  if (!base::FeatureList::IsEnabled(kSavePackageConcurrentFetches))
+    return 1;
+  return std::max(kMaxConcurrentNetSaveItems.Get(), 1);
+}
+
 // Strip current ordinal number, if any. Should only be used on pure
 // file names, i.e. those stripped of their extensions.
 // TODO(estade): improve this to not choke on alternate encodings.
@@ -884,7 +899,11 @@ void SavePackage::SaveNextFile(bool process_all_remaining_items) {
     FrameTreeNode* requester_frame_tree_node =
         FrameTreeNode::GloballyFindByID(requester_frame_tree_node_id);
     if (!requester_frame_tree_node) {
+      // The frame went away while the item was waiting. Nothing will call
+      // SaveFinished() for it, so move it out of |in_progress_items_| here;
+      // otherwise it would keep one of the concurrent fetch slots forever.
       save_item_ptr->Finish(0, /* is_success = */ false);
+      PutInProgressItemToSavedMap(save_item_ptr);
       continue;
     }
     RenderFrameHostImpl* requester_frame =
@@ -952,10 +971,21 @@ void SavePackage::DoSavingProcess() {
   // Start a new SaveItem job if we still have job in waiting queue.
   if (!waiting_item_queue_.empty()) {
     DCHECK_EQ(NET_FILES, wait_state_);
-    const SaveItem* save_item = waiting_item_queue_.front().get();
-    if (save_item->save_source() != SaveFileCreateInfo::SAVE_FILE_FROM_DOM) {
+    // Keep up to GetMaxConcurrentNetSaveItems() sub-resources in flight.
+    // SaveFinished() calls back here to start the next one as each of them
+    // completes.
+    const int max_in_flight = GetMaxConcurrentNetSaveItems();
+    while (!canceled() && !waiting_item_queue_.empty() &&
+           waiting_item_queue_.front()->save_source() !=
+               SaveFileCreateInfo::SAVE_FILE_FROM_DOM &&
+           in_process_count() < max_in_flight) {
       SaveNextFile(false);
-    } else if (!in_process_count()) {
+    }
+    // SaveNextFile() fails items whose frame is gone right away, so the loop
+    // above can also drain the sub-resources without leaving any in flight.
+    if (!canceled() && !waiting_item_queue_.empty() && !in_process_count()) {
+      DCHECK_EQ(SaveFileCreateInfo::SAVE_FILE_FROM_DOM,
+                waiting_item_queue_.front()->save_source());
       // If there is no in-process SaveItem, it means all sub-resources
       // have been processed. Now we need to start serializing HTML DOM
       // for the current page to get the generated HTML data.
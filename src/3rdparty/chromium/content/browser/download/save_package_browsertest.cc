@@ -7,21 +7,30 @@
 #include "base/functional/bind.h"
 #include "base/memory/raw_ptr.h"
 #include "base/run_loop.h"
+#include "base/strings/string_number_conversions.h"
+#include "base/strings/string_util.h"
+#include "base/strings/stringprintf.h"
 #include "base/task/sequenced_task_runner.h"
+#include "base/test/scoped_feature_list.h"
 #include "content/browser/download/download_manager_impl.h"
 #include "content/browser/download/save_package.h"
 #include "content/browser/web_contents/web_contents_impl.h"
+#include "content/common/features.h"
 #include "content/public/browser/browser_context.h"
 #include "content/public/browser/download_manager.h"
 #include "content/public/browser/web_contents.h"
 #include "content/public/test/browser_test.h"
+#include "content/public/test/browser_test_utils.h"
 #include "content/public/test/content_browser_test.h"
 #include "content/public/test/content_browser_test_utils.h"
 #include "content/public/test/download_test_observer.h"
 #include "content/public/test/fenced_frame_test_util.h"
 #include "content/shell/browser/shell.h"
 #include "content/shell/browser/shell_download_manager_delegate.h"
+#include "net/test/embedded_test_server/controllable_http_response.h"
 #include "net/test/embedded_test_server/embedded_test_server.h"
+#include "net/test/embedded_test_server/http_request.h"
+#include "net/test/embedded_test_server/http_response.h"
 #include "testing/gmock/include/gmock/gmock.h"
 
 namespace content {
@@ -272,6 +281,201 @@ IN_PROC_BROWSER_TEST_F(SavePackageBrowserTest, Reload) {
   download_manager->SetDelegate(old_delegate);
 }
 
+class SavePackageConcurrentFetchesBrowserTest : public SavePackageBrowserTest {
+ public:
+  static constexpr int kMaxInFlight = 2;
+
+  SavePackageConcurrentFetchesBrowserTest() {
+    feature_list_.InitAndEnableFeatureWithParameters(
+        kSavePackageConcurrentFetches,
+        {{"max_in_flight", base::NumberToString(kMaxInFlight)}});
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
+// Save a page with more sub-resources than are fetched at once as complete
+// HTML. Every sub-resource must still be saved, and the saved page must refer
+// to the local copies rather than the original URLs.
+IN_PROC_BROWSER_TEST_F(SavePackageConcurrentFetchesBrowserTest,
+                       SavesAllSubResources) {
+  constexpr int kNumImages = 3 * kMaxInFlight + 1;
+  embedded_test_server()->RegisterRequestHandler(base::BindRepeating(
+      [](int num_images, const net::test_server::HttpRequest& request)
+          -> std::unique_ptr<net::test_server::HttpResponse> {
+        auto response = std::make_unique<net::test_server::BasicHttpResponse>();
+        if (request.relative_url == "/many_images.html") {
+          std::string html = "<html><body>";
+          for (int i = 0; i < num_images; ++i)
+            base::StringAppendF(&html, "<img src=\"/image%d.png\">", i);
+          html += "</body></html>";
+          response->set_content_type("text/html");
+          response->set_content(html);
+          return response;
+        }
+        if (base::StartsWith(request.relative_url, "/image")) {
+          response->set_content_type("image/png");
+          response->set_content(request.relative_url);
+          return response;
+        }
+        return nullptr;
+      },
+      kNumImages));
+  ASSERT_TRUE(embedded_test_server()->Start());
+  EXPECT_TRUE(NavigateToURL(
+      shell(), embedded_test_server()->GetURL("/many_images.html")));
+  base::FilePath full_file_name, dir;
+  GetDestinationPaths("a", &full_file_name, &dir);
+
+  auto* download_manager = static_cast<DownloadManagerImpl*>(
+      shell()->web_contents()->GetBrowserContext()->GetDownloadManager());
+  auto delegate = std::make_unique<TestShellDownloadManagerDelegate>(
+      SAVE_PAGE_TYPE_AS_COMPLETE_HTML);
+  delegate->download_dir_ = save_dir_.GetPath();
+  auto* old_delegate = download_manager->GetDelegate();
+  download_manager->SetDelegate(delegate.get());
+
+  {
+    base::RunLoop run_loop;
+    DownloadCompleteObserver observer(run_loop.QuitClosure());
+    download_manager->AddObserver(&observer);
+    ASSERT_TRUE(shell()->web_contents()->SavePage(
+        full_file_name, dir, SAVE_PAGE_TYPE_AS_COMPLETE_HTML));
+    run_loop.Run();
+    download_manager->RemoveObserver(&observer);
+  }
+
+  download_manager->SetDelegate(old_delegate);
+
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  std::string html;
+  ASSERT_TRUE(base::ReadFileToString(full_file_name, &html));
+  EXPECT_THAT(html, testing::HasSubstr(dir.BaseName().AsUTF8Unsafe()));
+  for (int i = 0; i < kNumImages; ++i) {
+    const std::string file_name = base::StringPrintf("image%d.png", i);
+    EXPECT_TRUE(base::PathExists(dir.AppendASCII(file_name))) << file_name;
+    EXPECT_THAT(html, testing::HasSubstr(file_name));
+    EXPECT_THAT(html, testing::Not(testing::HasSubstr(
+                          embedded_test_server()->GetURL("/" + file_name)
+                              .spec())));
+  }
+}
+
+// Remove a sub-frame while its sub-resources are still waiting for a fetch
+// slot. Those sub-resources fail to save, but they must not keep slots busy
+// and the rest of the page must still be saved.
+IN_PROC_BROWSER_TEST_F(SavePackageConcurrentFetchesBrowserTest,
+                       DetachedFrameDoesNotStallSave) {
+  constexpr int kNumFrameImages = kMaxInFlight + 1;
+  // The main frame images are requested once when the page loads and once
+  // when it is saved. Holding the second responses keeps every fetch slot
+  // busy until the sub-frame is gone.
+  std::vector<std::unique_ptr<net::test_server::ControllableHttpResponse>>
+      load_responses;
+  std::vector<std::unique_ptr<net::test_server::ControllableHttpResponse>>
+      save_responses;
+  for (int i = 0; i < kMaxInFlight; ++i) {
+    const std::string path = base::StringPrintf("/slow%d.png", i);
+    load_responses.push_back(
+        std::make_unique<net::test_server::ControllableHttpResponse>(
+            embedded_test_server(), path));
+    save_responses.push_back(
+        std::make_unique<net::test_server::ControllableHttpResponse>(
+            embedded_test_server(), path));
+  }
+  embedded_test_server()->RegisterRequestHandler(base::BindRepeating(
+      [](int num_main_images, int num_frame_images,
+         const net::test_server::HttpRequest& request)
+          -> std::unique_ptr<net::test_server::HttpResponse> {
+        auto response = std::make_unique<net::test_server::BasicHttpResponse>();
+        if (request.relative_url == "/main.html") {
+          std::string html = "<html><body>";
+          for (int i = 0; i < num_main_images; ++i)
+            base::StringAppendF(&html, "<img src=\"/slow%d.png\">", i);
+          html += "<iframe src=\"/frame.html\"></iframe></body></html>";
+          response->set_content_type("text/html");
+          response->set_content(html);
+          return response;
+        }
+        if (request.relative_url == "/frame.html") {
+          std::string html = "<html><body>";
+          for (int i = 0; i < num_frame_images; ++i)
+            base::StringAppendF(&html, "<img src=\"/frame_image%d.png\">", i);
+          html += "</body></html>";
+          response->set_content_type("text/html");
+          response->set_content(html);
+          return response;
+        }
+        if (base::StartsWith(request.relative_url, "/frame_image")) {
+          response->set_content_type("image/png");
+          response->set_content(request.relative_url);
+          return response;
+        }
+        return nullptr;
+      },
+      kMaxInFlight, kNumFrameImages));
+  ASSERT_TRUE(embedded_test_server()->Start());
+
+  shell()->LoadURL(embedded_test_server()->GetURL("/main.html"));
+  for (auto& response : load_responses) {
+    response->WaitForRequest();
+    response->Send(net::HTTP_OK, "image/png", "slow", {},
+                   {"Cache-Control: no-store"});
+    response->Done();
+  }
+  EXPECT_TRUE(WaitForLoadStop(shell()->web_contents()));
+
+  base::FilePath full_file_name, dir;
+  GetDestinationPaths("a", &full_file_name, &dir);
+  auto* download_manager = static_cast<DownloadManagerImpl*>(
+      shell()->web_contents()->GetBrowserContext()->GetDownloadManager());
+  auto delegate = std::make_unique<TestShellDownloadManagerDelegate>(
+      SAVE_PAGE_TYPE_AS_COMPLETE_HTML);
+  delegate->download_dir_ = save_dir_.GetPath();
+  auto* old_delegate = download_manager->GetDelegate();
+  download_manager->SetDelegate(delegate.get());
+
+  {
+    base::RunLoop run_loop;
+    DownloadCompleteObserver observer(run_loop.QuitClosure());
+    download_manager->AddObserver(&observer);
+    ASSERT_TRUE(shell()->web_contents()->SavePage(
+        full_file_name, dir, SAVE_PAGE_TYPE_AS_COMPLETE_HTML));
+
+    // The main frame images come first in the queue, so once both are
+    // requested every slot is taken and the sub-frame images are waiting.
+    for (auto& response : save_responses)
+      response->WaitForRequest();
+
+    RenderFrameDeletedObserver frame_deleted_observer(
+        ChildFrameAt(shell()->web_contents()->GetPrimaryMainFrame(), 0));
+    EXPECT_TRUE(ExecJs(shell()->web_contents(),
+                       "document.querySelector('iframe').remove();"));
+    frame_deleted_observer.WaitUntilDeleted();
+
+    for (auto& response : save_responses) {
+      response->Send(net::HTTP_OK, "image/png", "slow");
+      response->Done();
+    }
+    run_loop.Run();
+    download_manager->RemoveObserver(&observer);
+  }
+
+  download_manager->SetDelegate(old_delegate);
+
+  base::ScopedAllowBlockingForTesting allow_blocking;
+  EXPECT_TRUE(base::PathExists(full_file_name));
+  for (int i = 0; i < kMaxInFlight; ++i) {
+    const std::string file_name = base::StringPrintf("slow%d.png", i);
+    EXPECT_TRUE(base::PathExists(dir.AppendASCII(file_name))) << file_name;
+  }
+  for (int i = 0; i < kNumFrameImages; ++i) {
+    const std::string file_name = base::StringPrintf("frame_image%d.png", i);
+    EXPECT_FALSE(base::PathExists(dir.AppendASCII(file_name))) << file_name;
+  }
+}
+
 class SavePackageFencedFrameBrowserTest : public SavePackageBrowserTest {
  public:
   test::FencedFrameTestHelper& fenced_frame_test_helper() {
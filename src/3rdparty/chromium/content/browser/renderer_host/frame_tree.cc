@@ -16,6 +16,7 @@
 #include "base/functional/callback.h"
 #include "base/lazy_instance.h"
 #include "base/memory/ptr_util.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/ranges/algorithm.h"
 #include "base/trace_event/optional_trace_event.h"
 #include "base/trace_event/typed_macros.h"
@@ -491,6 +492,11 @@ void FrameTree::CreateProxiesForSiteInstance(
     const scoped_refptr<BrowsingContextState>&
         source_new_browsing_context_state) {
   SiteInstanceGroup* group = site_instance->group();
+  // CreateRenderFrameProxy() is a no-op for frames that already have a live
+  // proxy in |group|, which is the common case on repeat navigations, so only
+  // count frames that don't have one yet.
+  int num_proxies_created = 0;
+
   // Create the RenderFrameProxyHost for the new SiteInstance.
   if (!source || !source->IsMainFrame()) {
     RenderViewHostImpl* render_view_host = GetRenderViewHost(group).get();
@@ -507,10 +513,13 @@ void FrameTree::CreateProxiesForSiteInstance(
       // in the right SiteInstance if it doesn't exist, before creating the
       // other proxies; if the `blink::WebView` doesn't exist, the only way to
       // do this is to also create a proxy for the main frame as well.
-      root()->render_manager()->CreateRenderFrameProxy(
-          site_instance,
+      const scoped_refptr<BrowsingContextState>& browsing_context_state =
           source ? source->parent()->GetMainFrame()->browsing_context_state()
-                 : root()->current_frame_host()->browsing_context_state());
+                 : root()->current_frame_host()->browsing_context_state();
+      if (!browsing_context_state->GetRenderFrameProxyHost(group))
+        ++num_proxies_created;
+      root()->render_manager()->CreateRenderFrameProxy(site_instance,
+                                                       browsing_context_state);
     }
   }
 
@@ -570,13 +579,24 @@ void FrameTree::CreateProxiesForSiteInstance(
       // |browsing_context_state| (as BrowsingContextState might change for
       // cross-BrowsingInstance navigations). Otherwise, we should use the
       // |node|'s current BrowsingContextState.
-      node->render_manager()->CreateRenderFrameProxy(
-          site_instance,
+      const scoped_refptr<BrowsingContextState>& browsing_context_state =
           node == source
               ? source_new_browsing_context_state
-              : node->current_frame_host()->browsing_context_state());
+              : node->current_frame_host()->browsing_context_state();
+      if (!browsing_context_state->GetRenderFrameProxyHost(group))
+        ++num_proxies_created;
+      node->render_manager()->CreateRenderFrameProxy(site_instance,
+                                                     browsing_context_state);
     }
   }
+
+  // Pages with many cross-site frames pay for a proxy per frame in every
+  // SiteInstanceGroup, so track how many proxies each group actually needed.
+  // Calls that found every proxy already in place aren't recorded.
+  if (num_proxies_created > 0) {
+    base::UmaHistogramCounts1000("Navigation.FrameTree.ProxiesPerSiteInstance",
+                                 num_proxies_created);
+  }
 }
 
 RenderFrameHostImpl* FrameTree::GetMainFrame() const {
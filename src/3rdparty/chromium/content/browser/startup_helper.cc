@@ -67,6 +67,11 @@ BASE_FEATURE(kBrowserThreadPoolAdjustment,
 
 const base::FeatureParam<int> kBrowserThreadPoolMin{
     &kBrowserThreadPoolAdjustment, "min", kThreadPoolDefaultMin};
+
+// Lets hosts with many cores raise the cap, e.g. when running many offscreen
+// pages. Never lower than |kBrowserThreadPoolMin|.
+const base::FeatureParam<int> kBrowserThreadPoolMax{
+    &kBrowserThreadPoolAdjustment, "max", kThreadPoolMax};
 }  // namespace
 
 // TODO(scheduler-dev): Standardize thread pool logic and remove the need for
@@ -75,9 +80,11 @@ void StartBrowserThreadPool() {
   // Ensure we always support at least one thread regardless of the field trial
   // param setting.
   auto min = static_cast<size_t>(std::max(kBrowserThreadPoolMin.Get(), 1));
+  auto max = std::max(
+      static_cast<size_t>(std::max(kBrowserThreadPoolMax.Get(), 1)), min);
   base::ThreadPoolInstance::InitParams thread_pool_init_params = {
       base::RecommendedMaxNumberOfThreadsInThreadGroup(
-          min, kThreadPoolMax, kThreadPoolCoresMultiplier, kThreadPoolOffset)};
+          min, max, kThreadPoolCoresMultiplier, kThreadPoolOffset)};
 
 #if BUILDFLAG(IS_WIN)
   thread_pool_init_params.common_thread_pool_environment = base::
@@ -30,6 +30,10 @@ BASE_FEATURE(kRestrictCanAccessDataForOriginToUIThread,
              "RestrictCanAccessDataForOriginToUIThread",
              base::FEATURE_ENABLED_BY_DEFAULT);
 
+BASE_FEATURE(kSavePackageConcurrentFetches,
+             "SavePackageConcurrentFetches",
+             base::FEATURE_ENABLED_BY_DEFAULT);
+
 BASE_FEATURE(kSpeculativeServiceWorkerStartup,
              "SpeculativeServiceWorkerStartup",
              base::FEATURE_DISABLED_BY_DEFAULT);
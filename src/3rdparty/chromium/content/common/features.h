@@ -38,6 +38,11 @@ BASE_DECLARE_FEATURE(kQueueNavigationsWhileWaitingForCommit);
 // https://crbug.com/1286501.
 BASE_DECLARE_FEATURE(kRestrictCanAccessDataForOriginToUIThread);
 
+// When saving a page as complete HTML, fetches several sub-resources from the
+// network at once instead of one after another. The "max_in_flight" param
+// sets how many.
+CONTENT_EXPORT BASE_DECLARE_FEATURE(kSavePackageConcurrentFetches);
+
 // (crbug/1377753): Speculatively start service worker before BeforeUnload runs.
 BASE_DECLARE_FEATURE(kSpeculativeServiceWorkerStartup);
 
@@ -191,6 +191,17 @@ std::unique_ptr<ScriptInjection> UserScriptSet::GetInjectionForScript(
     bool is_declarative,
     bool log_activity) {
   std::unique_ptr<ScriptInjection> injection;
+
+  // GetInjections() runs once per run location for every frame, and most
+  // scripts only have work to do at one of them. Bail out before the URL
+  // pattern and permission checks when there is nothing to inject here.
+  bool inject_css = !script->css_scripts().empty() &&
+                    run_location == mojom::RunLocation::kDocumentStart;
+  bool inject_js =
+      !script->js_scripts().empty() && script->run_location() == run_location;
+  if (!inject_css && !inject_js)
+    return injection;
+
   std::unique_ptr<const InjectionHost> injection_host;
   blink::WebLocalFrame* web_frame = render_frame->GetWebFrame();
 
@@ -225,15 +236,9 @@ std::unique_ptr<ScriptInjection> UserScriptSet::GetInjectionForScript(
     return injection;
   }
 
-  bool inject_css = !script->css_scripts().empty() &&
-                    run_location == mojom::RunLocation::kDocumentStart;
-  bool inject_js =
-      !script->js_scripts().empty() && script->run_location() == run_location;
-  if (inject_css || inject_js) {
-    injection = std::make_unique<ScriptInjection>(
-        std::move(injector), render_frame, std::move(injection_host),
-        run_location, log_activity);
-  }
+  injection = std::make_unique<ScriptInjection>(
+      std::move(injector), render_frame, std::move(injection_host),
+      run_location, log_activity);
   return injection;
 }
 
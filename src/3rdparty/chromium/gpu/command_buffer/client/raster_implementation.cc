@@ -23,6 +23,7 @@
 #include "base/functional/bind.h"
 #include "base/memory/raw_ptr.h"
 #include "base/metrics/histogram_macros.h"
+#include "base/numerics/safe_conversions.h"
 #include "base/numerics/safe_math.h"
 #include "base/trace_event/memory_allocator_dump.h"
 #include "base/trace_event/memory_dump_manager.h"
@@ -334,6 +335,7 @@ class RasterImplementation::PaintOpSerializer {
     // Send the raster command itself now that the commands for its
     // dependencies have been sent.
     ri_->UnmapRasterCHROMIUM(written_bytes_, total_written_size);
+    total_sent_bytes_ += total_written_size;
 
     // Now that we've issued the RasterCHROMIUM referencing the stashed
     // images, Reset the |stashing_image_provider_|, causing us to issue
@@ -347,6 +349,10 @@ class RasterImplementation::PaintOpSerializer {
 
   bool valid() const { return !!buffer_; }
 
+  // Bytes handed to the service across all RasterCHROMIUM commands issued by
+  // this serializer, including inlined transfer cache entries.
+  size_t total_sent_bytes() const { return total_sent_bytes_; }
+
  private:
   const raw_ptr<RasterImplementation> ri_;
   raw_ptr<char, AllowPtrArithmetic> buffer_;
@@ -356,6 +362,7 @@ class RasterImplementation::PaintOpSerializer {
 
   uint32_t written_bytes_ = 0;
   uint32_t free_bytes_ = 0;
+  size_t total_sent_bytes_ = 0;
 
   raw_ptr<size_t> max_op_size_hint_;
 };
@@ -1392,6 +1399,11 @@ void RasterImplementation::RasterCHROMIUM(const cc::DisplayItemList* list,
   serializer.Serialize(list->paint_op_buffer_, &temp_raster_offsets_, preamble);
   // TODO(piman): raise error if !serializer.valid()?
   op_serializer.SendSerializedData();
+
+  UMA_HISTOGRAM_CUSTOM_COUNTS("GPU.RasterCHROMIUM.SerializedBytes",
+                              base::saturated_cast<int>(
+                                  op_serializer.total_sent_bytes()),
+                              1, 16 * 1024 * 1024, 50);
 }
 
 void RasterImplementation::EndRasterCHROMIUM() {
@@ -822,6 +822,9 @@ bool SourceBufferStream::GarbageCollectIfNeeded(base::TimeDelta media_time,
     bytes_over_hard_memory_limit = ranges_size + newDataSize - memory_limit_;
 
   size_t bytes_to_free = ranges_size + newDataSize - effective_memory_limit;
+  TRACE_EVENT2("media", "SourceBufferStream::GarbageCollectIfNeeded",
+               "stream type", GetStreamTypeName(), "bytes to free",
+               bytes_to_free);
 
   DVLOG(2) << __func__ << " " << GetStreamTypeName()
            << ": Before GC media_time=" << media_time.InMicroseconds()
@@ -7,6 +7,7 @@
 #include <utility>
 
 #include "base/functional/bind.h"
+#include "base/metrics/histogram_macros.h"
 #include "base/time/time.h"
 #include "net/base/net_errors.h"
 
@@ -42,6 +43,8 @@ int CachingCertVerifier::Verify(const CertVerifier::RequestParams& params,
 
   const CertVerificationCache::value_type* cached_entry =
       cache_.Get(params, CacheValidityPeriod(base::Time::Now()));
+  UMA_HISTOGRAM_BOOLEAN("Net.CertVerifier.CachingCertVerifier.CacheHit",
+                        !!cached_entry);
   if (cached_entry) {
     ++cache_hits_;
     *verify_result = cached_entry->result;
@@ -6,6 +6,7 @@
 
 #include "base/files/file_path.h"
 #include "base/memory/ref_counted.h"
+#include "base/test/metrics/histogram_tester.h"
 #include "net/base/net_errors.h"
 #include "net/base/test_completion_callback.h"
 #include "net/cert/cert_verifier.h"
@@ -42,6 +43,7 @@ class CachingCertVerifierTest : public TestWithTaskEnvironment {
 };
 
 TEST_F(CachingCertVerifierTest, CacheHit) {
+  base::HistogramTester histograms;
   base::FilePath certs_dir = GetTestCertsDirectory();
   scoped_refptr<X509Certificate> test_cert(
       ImportCertFromFile(certs_dir, "ok_cert.pem"));
@@ -74,6 +76,11 @@ TEST_F(CachingCertVerifierTest, CacheHit) {
   ASSERT_EQ(2u, verifier_.requests());
   ASSERT_EQ(1u, verifier_.cache_hits());
   ASSERT_EQ(1u, verifier_.GetCacheSize());
+
+  histograms.ExpectBucketCount(
+      "Net.CertVerifier.CachingCertVerifier.CacheHit", false, 1);
+  histograms.ExpectBucketCount(
+      "Net.CertVerifier.CachingCertVerifier.CacheHit", true, 1);
 }
 
 TEST_F(CachingCertVerifierTest, CacheHitCTResultsCached) {
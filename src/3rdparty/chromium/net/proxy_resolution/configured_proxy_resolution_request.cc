@@ -8,6 +8,7 @@
 
 #include "base/functional/bind.h"
 #include "base/functional/callback_helpers.h"
+#include "base/metrics/histogram_macros.h"
 #include "net/base/net_errors.h"
 #include "net/log/net_log_event_type.h"
 #include "net/proxy_resolution/configured_proxy_resolution_service.h"
@@ -60,6 +61,7 @@ int ConfiguredProxyResolutionRequest::Start() {
   if (service_->ApplyPacBypassRules(url_, results_))
     return OK;
 
+  used_pac_resolver_ = true;
   return service_->GetProxyResolver()->GetProxyForURL(
       url_, network_anonymization_key_, results_,
       base::BindOnce(&ConfiguredProxyResolutionRequest::QueryComplete,
@@ -80,6 +82,9 @@ void ConfiguredProxyResolutionRequest::CancelResolveJob() {
   DCHECK(is_started());
   // The request may already be running in the resolver.
   resolve_job_.reset();
+  // The request is restarted once the new configuration is ready, and may then
+  // complete without the PAC resolver.
+  used_pac_resolver_ = false;
   DCHECK(!is_started());
 }
 
@@ -96,8 +101,17 @@ int ConfiguredProxyResolutionRequest::QueryDidComplete(int result_code) {
 
   // Make a note in the results which configuration was in use at the
   // time of the resolve.
+  const base::TimeTicks now = base::TimeTicks::Now();
   results_->set_proxy_resolve_start_time(creation_time_);
-  results_->set_proxy_resolve_end_time(base::TimeTicks::Now());
+  results_->set_proxy_resolve_end_time(now);
+
+  // Time the request waited on PAC evaluation, including any wait for the
+  // resolver to be initialized.
+  if (used_pac_resolver_ && result_code != ERR_ABORTED) {
+    UMA_HISTOGRAM_TIMES("Net.ProxyResolutionService.PacRequestDuration",
+                        now - creation_time_);
+  }
+  used_pac_resolver_ = false;
 
   // If annotation is not already set, e.g. through TryToCompleteSynchronously
   // function, use in-progress-resolve annotation.
@@ -93,6 +93,8 @@ class ConfiguredProxyResolutionRequest final : public ProxyResolutionRequest {
   // Time when the request was created.  Stored here rather than in |results_|
   // because the time in |results_| will be cleared.
   base::TimeTicks creation_time_;
+  // True once the request has been handed to the PAC resolver.
+  bool used_pac_resolver_ = false;
 };
 
 }  // namespace net
@@ -931,6 +931,63 @@ TEST_F(ConfiguredProxyResolutionServiceTest, PAC) {
                                   NetLogEventType::PROXY_RESOLUTION_SERVICE));
 }
 
+// Requests answered by the PAC resolver are recorded in
+// Net.ProxyResolutionService.PacRequestDuration, but a request whose PAC job
+// is cancelled by a switch to fixed proxy rules, and which then completes
+// synchronously from those rules, is not.
+TEST_F(ConfiguredProxyResolutionServiceTest, PAC_RequestDurationHistogram) {
+  const char kHistogram[] = "Net.ProxyResolutionService.PacRequestDuration";
+  base::HistogramTester histograms;
+
+  auto config_service =
+      std::make_unique<MockProxyConfigService>("http://foopy/proxy.pac");
+  auto* config_service_ptr = config_service.get();
+  MockAsyncProxyResolver resolver;
+  auto factory = std::make_unique<MockAsyncProxyResolverFactory>(false);
+  auto* factory_ptr = factory.get();
+  ConfiguredProxyResolutionService service(std::move(config_service),
+                                           std::move(factory), nullptr,
+                                           /*quick_check_enabled=*/true);
+
+  GURL url("http://www.google.com/");
+
+  // The first request is answered by the PAC script.
+  ProxyInfo info1;
+  TestCompletionCallback callback1;
+  std::unique_ptr<ProxyResolutionRequest> request1;
+  int rv = service.ResolveProxy(url, std::string(), NetworkAnonymizationKey(),
+                                &info1, callback1.callback(), &request1,
+                                NetLogWithSource());
+  EXPECT_THAT(rv, IsError(ERR_IO_PENDING));
+  ASSERT_EQ(1u, factory_ptr->pending_requests().size());
+  factory_ptr->pending_requests()[0]->CompleteNowWithForwarder(OK, &resolver);
+  ASSERT_EQ(1u, resolver.pending_jobs().size());
+  resolver.pending_jobs()[0]->results()->UseNamedProxy("foopy");
+  resolver.pending_jobs()[0]->CompleteNow(OK);
+  EXPECT_THAT(callback1.WaitForResult(), IsOk());
+  histograms.ExpectTotalCount(kHistogram, 1);
+
+  // The second request is handed to the PAC resolver, but the configuration
+  // changes to fixed proxy rules before the resolver answers.
+  ProxyInfo info2;
+  TestCompletionCallback callback2;
+  std::unique_ptr<ProxyResolutionRequest> request2;
+  rv = service.ResolveProxy(url, std::string(), NetworkAnonymizationKey(),
+                            &info2, callback2.callback(), &request2,
+                            NetLogWithSource());
+  EXPECT_THAT(rv, IsError(ERR_IO_PENDING));
+  ASSERT_EQ(1u, resolver.pending_jobs().size());
+
+  ProxyConfig config;
+  config.proxy_rules().ParseFromString("foopy1:8080");
+  config_service_ptr->SetConfig(
+      ProxyConfigWithAnnotation(config, TRAFFIC_ANNOTATION_FOR_TESTS));
+
+  EXPECT_THAT(callback2.WaitForResult(), IsOk());
+  EXPECT_EQ("foopy1:8080", ProxyServerToProxyUri(info2.proxy_server()));
+  histograms.ExpectTotalCount(kHistogram, 1);
+}
+
 // Test that the proxy resolver does not see the URL's username/password
 // or its reference section.
 TEST_F(ConfiguredProxyResolutionServiceTest, PAC_NoIdentityOrHash) {
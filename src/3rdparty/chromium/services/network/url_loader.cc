@@ -1767,6 +1767,7 @@ void URLLoader::ReadMore() {
     }
     if (result == MOJO_RESULT_SHOULD_WAIT) {
       // The pipe is full. We need to wait for it to have more space.
+      ++num_body_pipe_full_waits_;
       writable_handle_watcher_.ArmOrNotify();
       return;
     }
@@ -2062,6 +2063,15 @@ void URLLoader::NotifyCompleted(int error_code) {
         url_request_->GetTotalSentBytes());
   }
 
+  // Only large bodies can fill the pipe, so don't dilute the metric with the
+  // bulk of small loads.
+  constexpr int64_t kMinBodySizeForPipeFullMetric = 1024 * 1024;
+  if (total_written_bytes_ >= kMinBodySizeForPipeFullMetric) {
+    base::UmaHistogramCounts1000(
+        "NetworkService.URLLoader.LargeBodyPipeFullWaits",
+        num_body_pipe_full_waits_);
+  }
+
   if (url_loader_client_.Get()) {
     if (consumer_handle_.is_valid())
       SendResponseToClient();
@@ -530,6 +530,10 @@ class COMPONENT_EXPORT(NETWORK_SERVICE) URLLoader
   mojo::SimpleWatcher writable_handle_watcher_;
   mojo::SimpleWatcher peer_closed_handle_watcher_;
 
+  // Number of times reading the body had to wait for the consumer to drain a
+  // full response body pipe.
+  int num_body_pipe_full_waits_ = 0;
+
   // True if there's a URLRequest::Read() call in progress.
   bool read_in_progress_ = false;
 
@@ -55,6 +55,15 @@ bool DatabaseMemoryDumpProvider::OnMemoryDump(
   dump->AddScalar("statement_size",
                   base::trace_event::MemoryAllocatorDump::kUnitsBytes,
                   memory_usage.statement_size);
+  dump->AddScalar("cache_hit",
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  memory_usage.cache_hit);
+  dump->AddScalar("cache_miss",
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  memory_usage.cache_miss);
+  dump->AddScalar("cache_write",
+                  base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+                  memory_usage.cache_write);
   return true;
 }
 
@@ -120,6 +129,27 @@ DatabaseMemoryDumpProvider::GetDbMemoryUsage() {
   DCHECK_EQ(sqlite_result_code, SqliteResultCode::kOk)
       << "sqlite3_db_status(SQLITE_DBSTATUS_STMT_USED) failed";
 
+  // The page cache counters are cumulative. Like the calls above, these don't
+  // reset the counters, so consecutive dumps can be diffed to get the I/O done
+  // by the connection in between.
+  sqlite_result_code = ToSqliteResultCode(sqlite3_db_status(
+      db_, SQLITE_DBSTATUS_CACHE_HIT, &result.cache_hit, &high_watermark,
+      /*resetFlg=*/0));
+  DCHECK_EQ(sqlite_result_code, SqliteResultCode::kOk)
+      << "sqlite3_db_status(SQLITE_DBSTATUS_CACHE_HIT) failed";
+
+  sqlite_result_code = ToSqliteResultCode(sqlite3_db_status(
+      db_, SQLITE_DBSTATUS_CACHE_MISS, &result.cache_miss, &high_watermark,
+      /*resetFlg=*/0));
+  DCHECK_EQ(sqlite_result_code, SqliteResultCode::kOk)
+      << "sqlite3_db_status(SQLITE_DBSTATUS_CACHE_MISS) failed";
+
+  sqlite_result_code = ToSqliteResultCode(sqlite3_db_status(
+      db_, SQLITE_DBSTATUS_CACHE_WRITE, &result.cache_write, &high_watermark,
+      /*resetFlg=*/0));
+  DCHECK_EQ(sqlite_result_code, SqliteResultCode::kOk)
+      << "sqlite3_db_status(SQLITE_DBSTATUS_CACHE_WRITE) failed";
+
   result.is_valid = true;
   return result;
 }
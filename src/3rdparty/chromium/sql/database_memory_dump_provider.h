@@ -50,6 +50,10 @@ class DatabaseMemoryDumpProvider
     int cache_size = 0;
     int schema_size = 0;
     int statement_size = 0;
+    // Page cache hits, misses and writes since the connection was opened.
+    int cache_hit = 0;
+    int cache_miss = 0;
+    int cache_write = 0;
   };
   MemoryUsageResult GetDbMemoryUsage();
 
@@ -1589,6 +1589,32 @@ TEST_P(SQLDatabaseTest, OnMemoryDump) {
   EXPECT_GE(pmd.allocator_dumps().size(), 1u);
 }
 
+TEST_P(SQLDatabaseTest, OnMemoryDumpReportsPageCacheCounters) {
+  ASSERT_TRUE(db_->Execute("CREATE TABLE rows(id INTEGER PRIMARY KEY)"));
+  ASSERT_TRUE(db_->Execute("INSERT INTO rows(id) VALUES(1)"));
+  ASSERT_TRUE(db_->Execute("SELECT id FROM rows"));
+
+  base::trace_event::MemoryDumpArgs args = {
+      base::trace_event::MemoryDumpLevelOfDetail::DETAILED};
+  base::trace_event::ProcessMemoryDump pmd(args);
+  ASSERT_TRUE(db_->memory_dump_provider_->OnMemoryDump(args, &pmd));
+  ASSERT_EQ(pmd.allocator_dumps().size(), 1u);
+
+  uint64_t cache_hit = 0;
+  uint64_t cache_miss = 0;
+  bool has_cache_write = false;
+  for (const auto& entry : pmd.allocator_dumps().begin()->second->entries()) {
+    if (entry.name == "cache_hit")
+      cache_hit = entry.value_uint64;
+    else if (entry.name == "cache_miss")
+      cache_miss = entry.value_uint64;
+    else if (entry.name == "cache_write")
+      has_cache_write = true;
+  }
+  EXPECT_GT(cache_hit + cache_miss, 0u);
+  EXPECT_TRUE(has_cache_write);
+}
+
 // Test that the functions to collect diagnostic data run to completion, without
 // worrying too much about what they generate (since that will change).
 TEST_P(SQLDatabaseTest, CollectDiagnosticInfo) {
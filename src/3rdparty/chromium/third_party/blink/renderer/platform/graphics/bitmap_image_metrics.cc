@@ -5,9 +5,12 @@
 #include "third_party/blink/renderer/platform/graphics/bitmap_image_metrics.h"
 
 #include "base/metrics/histogram_base.h"
+#include "base/metrics/histogram_functions.h"
 #include "base/metrics/histogram_macros.h"
 #include "base/notreached.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/strings/strcat.h"
+#include "cc/base/devtools_instrumentation.h"
 #include "media/media_buildflags.h"
 #include "third_party/blink/public/common/buildflags.h"
 #include "third_party/blink/public/mojom/use_counter/metrics/web_feature.mojom-blink.h"
@@ -110,6 +113,11 @@ void BitmapImageMetrics::CountDecodedImageFrameTime(
       break;
     case BitmapImageMetrics::DecodedImageType::kAVIF:
       UMA_HISTOGRAM_TIMES("Blink.ImageDecoders.Avif.EveryDecode.Time", elapsed);
+      base::UmaHistogramTimes(
+          base::StrCat({"Blink.ImageDecoders.Avif.EveryDecode.Time.",
+                        cc::devtools_instrumentation::ImageDecodeSizeSuffix(
+                            original_frame_rect_area)}),
+          elapsed);
       if (first) {
         UMA_HISTOGRAM_TIMES("Blink.ImageDecoders.Avif.FirstDecode.Time",
                             elapsed);
@@ -117,7 +117,12 @@ void ContentLayerClientImpl::UpdateCcPictureLayer(
     return;
   }
 
+  // A layer usually records about as much as it did last time, so start the
+  // new list at the previous list's size.
+  const size_t previous_op_bytes =
+      cc_display_item_list_ ? cc_display_item_list_->RecordedOpBytes() : 0;
   cc_display_item_list_ = base::MakeRefCounted<cc::DisplayItemList>();
+  cc_display_item_list_->ReserveOpStorage(previous_op_bytes);
   PaintChunksToCcLayer::ConvertInto(
       paint_chunks, layer_state, layer_offset,
       base::OptionalToPtr(raster_under_invalidation_params),
@@ -690,14 +690,16 @@ void PaintController::AppendSubsequenceByMoving(const DisplayItemClient& client,
 
 DISABLE_CFI_PERF
 void PaintController::CommitNewDisplayItems() {
-  TRACE_EVENT2(
+  TRACE_EVENT(
       "blink,benchmark", "PaintController::commitNewDisplayItems",
       "current_display_list_size",
       current_paint_artifact_
           ? current_paint_artifact_->GetDisplayItemList().size()
           : 0,
       "num_non_cached_new_items",
-      new_paint_artifact_->GetDisplayItemList().size() - num_cached_new_items_);
+      new_paint_artifact_->GetDisplayItemList().size() - num_cached_new_items_,
+      "num_cached_new_items", num_cached_new_items_,
+      "num_cached_new_subsequences", num_cached_new_subsequences_);
 
   if (counter_for_testing_) {
     counter_for_testing_->num_cached_items += num_cached_new_items_;
@@ -17,6 +17,7 @@
 #include "base/memory/scoped_refptr.h"
 #include "base/numerics/safe_conversions.h"
 #include "base/ranges/algorithm.h"
+#include "base/system/sys_info.h"
 #include "base/timer/elapsed_timer.h"
 #include "build/build_config.h"
 #include "cc/base/math_util.h"
@@ -47,6 +48,11 @@ namespace {
 // known.
 constexpr uint64_t kMaxAvifFileSize = 0x10000000;  // 256 MB
 
+// The maximum number of threads dav1d may use for a single image. Several
+// images may be decoded concurrently on the raster worker threads, so this is
+// kept well below the processor count of large machines.
+constexpr int kMaxDecoderThreads = 4;
+
 const char* AvifDecoderErrorMessage(const avifDecoder* decoder) {
   // decoder->diag.error is a char array that stores a null-terminated C string.
   return *decoder->diag.error != '\0' ? decoder->diag.error
@@ -766,13 +772,14 @@ bool AVIFImageDecoder::UpdateDemuxer() {
     if (!decoder_)
       return false;
 
-    // For simplicity, use a hardcoded maxThreads of 2, independent of the image
-    // size and processor count. Note: even if we want maxThreads to depend on
-    // the image size, it is impossible to do so because maxThreads is passed to
-    // dav1d_open() inside avifDecoderParse(), but the image size is not known
-    // until avifDecoderParse() returns successfully. See
-    // https://github.com/AOMediaCodec/libavif/issues/636.
-    decoder_->maxThreads = 2;
+    // Use up to kMaxDecoderThreads threads, limited by the processor count, so
+    // that single-core devices don't spawn an idle thread and larger devices
+    // decode faster. Note: maxThreads cannot depend on the image size because
+    // maxThreads is passed to dav1d_open() inside avifDecoderParse(), but the
+    // image size is not known until avifDecoderParse() returns successfully.
+    // See https://github.com/AOMediaCodec/libavif/issues/636.
+    decoder_->maxThreads =
+        std::clamp(base::SysInfo::NumberOfProcessors(), 1, kMaxDecoderThreads);
 
     if (animation_option_ != AnimationOption::kUnspecified &&
         avifDecoderSetSource(